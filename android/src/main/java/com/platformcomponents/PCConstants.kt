@@ -17,4 +17,9 @@ object PCConstants {
 
     /** Fallback width in dp when constraint width is unavailable */
     const val FALLBACK_WIDTH_DP = 320f
+
+    // MARK: - Popups
+
+    /** Width of the virtualized headless popup (rows aren't measured up front, so it can't wrap content) */
+    const val VIRTUALIZED_POPUP_WIDTH_DP = 280f
 }
@@ -0,0 +1,91 @@
+package com.platformcomponents
+
+/**
+ * Windowed access to SelectionMenu options held by the C++ shadow tree
+ * (see shared/PCSelectionMenuOptionProvider.h).
+ *
+ * Only the option count crosses JNI up front. Rows are fetched a window at a
+ * time as adapters bind them and kept in a fixed set of recycled slots, so
+ * memory stays flat no matter how many options the menu has.
+ */
+internal class PCSelectionMenuOptionProvider(private val tag: Int) {
+
+  /** Option count as of the last [mount]; adapters must not see it change silently. */
+  var count: Int = 0
+    private set
+
+  private var slots: Array<PCSelectionMenuView.Option?> = emptyArray()
+  // Row index held by each slot (-1 = empty), so a slot is never read for another row.
+  private var slotRows: IntArray = IntArray(0)
+  private val outLocation = IntArray(1)
+
+  /**
+   * Switches to the options of the props revision this view just received and
+   * drops fetched rows. Returns false if C++ has no props for that revision.
+   */
+  fun mount(revision: Int): Boolean {
+    slots = emptyArray()
+    slotRows = IntArray(0)
+    val mounted = nativeMount(tag, revision)
+    count = if (mounted) nativeCount(tag) else 0
+    return mounted
+  }
+
+  fun indexOfData(data: String): Int =
+    if (data.isEmpty()) -1 else nativeIndexOfData(tag, data)
+
+  fun optionAt(index: Int): PCSelectionMenuView.Option? {
+    if (index < 0 || index >= count) return null
+
+    if (slots.isEmpty()) {
+      val capacity = nativeCapacity(tag)
+      if (capacity <= 0) return null
+      slots = arrayOfNulls(capacity)
+      slotRows = IntArray(capacity) { -1 }
+      nativeInvalidate(tag)
+    }
+
+    // null: the row doesn't exist natively. Otherwise only rows that entered
+    // the window come back; they overwrite evicted slots.
+    val rows = nativeRequestRow(tag, index, outLocation) ?: return null
+    val location = outLocation[0]
+    for (i in 0 until rows.size / 2) {
+      val slot = (location + i) % slots.size
+      slots[slot] = PCSelectionMenuView.Option(label = rows[i * 2], data = rows[i * 2 + 1])
+      slotRows[slot] = location + i
+    }
+
+    val slot = index % slots.size
+    return if (slotRows[slot] == index) slots[slot] else null
+  }
+
+  /**
+   * Reads every option of the mounted revision. Only used to leave
+   * virtualized mode, so the view never keeps its own copy of the list.
+   */
+  fun readAll(): List<PCSelectionMenuView.Option> {
+    val rows = nativeReadAll(tag) ?: return emptyList()
+    return List(rows.size / 2) { i ->
+      PCSelectionMenuView.Option(label = rows[i * 2], data = rows[i * 2 + 1])
+    }
+  }
+
+  fun release() {
+    slots = emptyArray()
+    slotRows = IntArray(0)
+    count = 0
+    nativeRelease(tag)
+  }
+
+  companion object {
+    // Implemented in android/src/main/jni/PCSelectionMenuOptionProviderJni.cpp
+    @JvmStatic external fun nativeMount(tag: Int, revision: Int): Boolean
+    @JvmStatic external fun nativeCount(tag: Int): Int
+    @JvmStatic external fun nativeCapacity(tag: Int): Int
+    @JvmStatic external fun nativeIndexOfData(tag: Int, data: String): Int
+    @JvmStatic external fun nativeRequestRow(tag: Int, index: Int, outLocation: IntArray): Array<String>?
+    @JvmStatic external fun nativeReadAll(tag: Int): Array<String>?
+    @JvmStatic external fun nativeInvalidate(tag: Int)
+    @JvmStatic external fun nativeRelease(tag: Int)
+  }
+}
@@ -3,15 +3,22 @@ package com.platformcomponents
 import android.content.Context
 import android.text.InputType
 import android.util.Log
+import android.view.LayoutInflater
 import android.view.View
 import android.view.ViewGroup
 import android.view.ViewTreeObserver
 import android.widget.AdapterView
 import android.widget.ArrayAdapter
+import android.widget.BaseAdapter
+import android.widget.Filter
+import android.widget.Filterable
 import android.widget.FrameLayout
 import android.widget.LinearLayout
 import android.widget.Spinner
+import android.widget.TextView
+import androidx.appcompat.widget.ListPopupWindow
 import androidx.appcompat.widget.PopupMenu
+import com.facebook.react.bridge.ReadableArray
 import com.facebook.react.bridge.WritableNativeMap
 import com.facebook.react.uimanager.PixelUtil
 import com.facebook.react.uimanager.StateWrapper
@@ -25,6 +32,19 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
 
   companion object {
     private const val TAG = "PCSelectionMenu"
+
+    fun parseOptions(value: ReadableArray?): List<Option> {
+      val out = ArrayList<Option>()
+      if (value != null) {
+        for (i in 0 until value.size()) {
+          val m = value.getMap(i) ?: continue
+          val label = if (m.hasKey("label") && !m.isNull("label")) m.getString("label") ?: "" else ""
+          val data = if (m.hasKey("data") && !m.isNull("data")) m.getString("data") ?: "" else ""
+          out.add(Option(label = label, data = data))
+        }
+      }
+      return out
+    }
   }
 
   // --- State Wrapper for Fabric state updates ---
@@ -46,6 +66,18 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
   // Only used to choose inline rendering style.
   var androidMaterial: String? = "system" // "system" | "m3"
 
+  var virtualization: String = "disabled" // "enabled" | "disabled"
+
+  // --- Virtualized options ---
+  // Raw prop kept unread while virtualized (ReadableNativeArray imports lazily).
+  private var optionsSource: ReadableArray? = null // only held until commitOptions()
+  private var optionsSourceDirty = false
+  private var optionsRevision = 0 // matches the C++ props this view received
+  private var optionsRevisionDirty = false
+  private var virtualizationDirty = false
+  private var optionProvider: PCSelectionMenuOptionProvider? = null
+  private var virtualizedSelectedIndex = -1
+
   // --- Events ---
   var onSelect: ((index: Int, label: String, data: String) -> Unit)? = null
   var onRequestClose: (() -> Unit)? = null
@@ -59,6 +91,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
 
   // --- Headless UI (true picker) ---
   private var headlessMenu: PopupMenu? = null
+  private var headlessList: ListPopupWindow? = null // virtualized
   private var headlessMenuShowing = false
   private var headlessDismissProgrammatic = false
   private var headlessDismissAfterSelect = false
@@ -211,6 +244,75 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
 
   // ---- Public apply* (called by manager) ----
 
+  // `options`, `optionsRevision` and `virtualization` arrive in any order; all are
+  // resolved in commitOptions().
+  fun applyOptionsSource(value: ReadableArray?) {
+    optionsSource = value
+    optionsSourceDirty = true
+  }
+
+  fun applyOptionsRevision(value: Int) {
+    if (optionsRevision == value) return
+    optionsRevision = value
+    optionsRevisionDirty = true
+  }
+
+  fun applyVirtualization(value: String?) {
+    val next = if (value == "enabled") "enabled" else "disabled"
+    if (virtualization == next) return
+    virtualization = next
+    virtualizationDirty = true
+    Log.d(TAG, "applyVirtualization virtualization=$virtualization")
+  }
+
+  /**
+   * Called after every props transaction, so options are only parsed when the
+   * menu is not virtualized. The `options` array is never kept past this call:
+   * a ReadableNativeArray holds a native copy of the whole list.
+   */
+  fun commitOptions() {
+    val source = optionsSource
+    val sourceChanged = optionsSourceDirty
+    val revisionChanged = optionsRevisionDirty
+    optionsSource = null
+    optionsSourceDirty = false
+    optionsRevisionDirty = false
+
+    if (virtualizationDirty) {
+      virtualizationDirty = false
+      if (isVirtualized()) {
+        options = emptyList()
+        mountOptionProvider()
+      } else {
+        // `options` may not be resent with this update; the still-mounted
+        // provider has the list the view was showing.
+        options =
+          if (sourceChanged) parseOptions(source) else optionProvider?.readAll() ?: emptyList()
+        releaseOptionProvider()
+      }
+      rebuildUI()
+      return
+    }
+
+    if (isVirtualized()) {
+      // Android may resend every prop on unrelated updates; only a new
+      // revision means the options changed.
+      if (!revisionChanged) return
+      Log.d(TAG, "commitOptions virtualized revision=$optionsRevision")
+      mountOptionProvider()
+      refreshAdapters()
+      refreshSelections()
+    } else if (sourceChanged) {
+      applyOptions(parseOptions(source))
+    }
+  }
+
+  fun releaseOptionProvider() {
+    optionProvider?.release()
+    optionProvider = null
+    virtualizedSelectedIndex = -1
+  }
+
   fun applyOptions(newOptions: List<Option>) {
     if (options == newOptions) return
     options = newOptions
@@ -237,7 +339,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
       Log.d(TAG, "applyInteractivity disabled while open -> requestClose")
       if (anchorMode == "headless" && headlessMenuShowing) {
         headlessDismissProgrammatic = true
-        headlessMenu?.dismiss()
+        dismissHeadless()
       } else {
         onRequestClose?.invoke()
       }
@@ -268,7 +370,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
       headlessOpenToken += 1
       if (headlessMenuShowing) {
         headlessDismissProgrammatic = true
-        headlessMenu?.dismiss()
+        dismissHeadless()
       }
     }
     rebuildUI()
@@ -291,7 +393,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
       Log.d(TAG, "applyVisible close -> dismiss")
       if (headlessMenuShowing) {
         headlessDismissProgrammatic = true
-        headlessMenu?.dismiss()
+        dismissHeadless()
       }
     }
   }
@@ -308,7 +410,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
   private fun rebuildUI() {
     if (headlessMenuShowing) {
       headlessDismissProgrammatic = true
-      headlessMenu?.dismiss()
+      dismissHeadless()
     }
     inlineText?.dismissDropDown()
     detachInlineDropdownOverlay()
@@ -319,6 +421,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
     inlineSpinner = null
     inlineSpinnerSuppressCount = 0
     headlessMenu = null
+    headlessList = null
     headlessMenuShowing = false
     headlessDismissProgrammatic = false
     headlessDismissAfterSelect = false
@@ -390,8 +493,9 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
         setOnClickListener { showDropDown() }
 
         setOnItemClickListener { _, _, position, _ ->
-          val opt = options.getOrNull(position) ?: return@setOnItemClickListener
+          val opt = optionAt(position) ?: return@setOnItemClickListener
           selectedData = opt.data
+          if (isVirtualized()) virtualizedSelectedIndex = position
           onSelect?.invoke(position, opt.label, opt.data)
           detachInlineDropdownOverlay()
         }
@@ -460,7 +564,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
 
           if (interactivity != "enabled") return
 
-          val opt = options.getOrNull(position) ?: return
+          val opt = optionAt(position) ?: return
 
           // Only fire callback if selection actually changed
           if (opt.data == selectedData) return
@@ -489,10 +593,15 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
   }
 
   private fun buildHeadless() {
+    if (isVirtualized()) {
+      buildHeadlessList()
+      return
+    }
+
     val popup = PopupMenu(context, this@PCSelectionMenuView).apply {
       setOnMenuItemClickListener { item ->
         val index = item.itemId
-        val opt = options.getOrNull(index)
+        val opt = optionAt(index)
         Log.d(
           TAG,
           "headless onMenuItemClick index=$index optData=${opt?.data} selectedData=$selectedData"
@@ -501,18 +610,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
         handleHeadlessSelection(index)
         true
       }
-      setOnDismissListener {
-        val programmatic = headlessDismissProgrammatic || headlessDismissAfterSelect
-        headlessDismissProgrammatic = false
-        headlessDismissAfterSelect = false
-        headlessMenuShowing = false
-        if (programmatic) {
-          Log.d(TAG, "headless onDismiss programmatic")
-        } else {
-          Log.d(TAG, "headless onDismiss -> requestClose")
-          onRequestClose?.invoke()
-        }
-      }
+      setOnDismissListener { handleHeadlessDismiss() }
     }
 
     headlessMenu = popup
@@ -520,6 +618,50 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
     refreshHeadlessMenu()
   }
 
+  // Virtualized: PopupMenu needs every item up front, so use a recycling list popup.
+  private fun buildHeadlessList() {
+    val list = ListPopupWindow(context).apply {
+      anchorView = this@PCSelectionMenuView
+      isModal = true
+      width = (PCConstants.VIRTUALIZED_POPUP_WIDTH_DP * resources.displayMetrics.density).toInt()
+      setAdapter(
+        VirtualizedOptionAdapter(
+          android.R.layout.simple_list_item_1,
+          android.R.layout.simple_list_item_1,
+          markSelected = true
+        )
+      )
+      setOnItemClickListener { _, _, position, _ ->
+        Log.d(TAG, "headless list onItemClick index=$position selectedData=$selectedData")
+        headlessDismissAfterSelect = true
+        handleHeadlessSelection(position)
+        dismiss()
+      }
+      setOnDismissListener { handleHeadlessDismiss() }
+    }
+
+    headlessList = list
+    Log.d(TAG, "buildHeadlessList list=${System.identityHashCode(list)}")
+  }
+
+  private fun handleHeadlessDismiss() {
+    val programmatic = headlessDismissProgrammatic || headlessDismissAfterSelect
+    headlessDismissProgrammatic = false
+    headlessDismissAfterSelect = false
+    headlessMenuShowing = false
+    if (programmatic) {
+      Log.d(TAG, "headless onDismiss programmatic")
+    } else {
+      Log.d(TAG, "headless onDismiss -> requestClose")
+      onRequestClose?.invoke()
+    }
+  }
+
+  private fun dismissHeadless() {
+    headlessMenu?.dismiss()
+    headlessList?.dismiss()
+  }
+
   private fun updateEnabledState() {
     val enabled = interactivity == "enabled"
     inlineLayout?.isEnabled = enabled
@@ -528,6 +670,11 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
   }
 
   private fun refreshAdapters() {
+    if (isVirtualized()) {
+      refreshVirtualizedAdapters()
+      return
+    }
+
     val labels = options.map { it.label }
 
     inlineText?.let { actv ->
@@ -551,12 +698,22 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
   }
 
   private fun refreshSelections() {
-    val idx = options.indexOfFirst { it.data == selectedData }
+    val idx = if (isVirtualized()) {
+      optionProvider?.indexOfData(selectedData) ?: -1
+    } else {
+      options.indexOfFirst { it.data == selectedData }
+    }
+    if (isVirtualized()) {
+      virtualizedSelectedIndex = idx
+      // Refresh the ✓ marker in the headless list
+      (headlessList?.listView?.adapter as? BaseAdapter)?.notifyDataSetChanged()
+    }
 
     inlineText?.let { actv ->
-      if (idx >= 0) {
+      val opt = if (idx >= 0) optionAt(idx) else null
+      if (opt != null) {
         // Show selected value
-        actv.setText(options[idx].label, false)
+        actv.setText(opt.label, false)
       } else {
         // Clear text to show placeholder
         actv.setText("", false)
@@ -564,7 +721,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
     }
 
     inlineSpinner?.let { sp ->
-      if (options.isEmpty()) return
+      if (optionCount() == 0) return
       val target = if (idx >= 0) idx else 0
       // Always call setSelection to ensure the view is refreshed
       // Even if the position hasn't changed, we need to update the displayed text
@@ -642,7 +799,7 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
   // ---- Headless open ----
 
   private fun presentHeadlessIfNeeded(token: Int) {
-    val popup = headlessMenu ?: return
+    if (headlessMenu == null && headlessList == null) return
     if (interactivity != "enabled") {
       Log.d(TAG, "presentHeadlessIfNeeded interactivity=$interactivity -> requestClose")
       onRequestClose?.invoke()
@@ -673,19 +830,29 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
 
       refreshHeadlessMenu()
       if (!headlessMenuShowing) {
-        Log.d(TAG, "presentHeadlessIfNeeded show items=${options.size}")
+        if (headlessList != null && optionCount() == 0) {
+          Log.d(TAG, "presentHeadlessIfNeeded no options -> requestClose")
+          onRequestClose?.invoke()
+          return@post
+        }
+        Log.d(TAG, "presentHeadlessIfNeeded show items=${optionCount()}")
         headlessDismissProgrammatic = false
         headlessDismissAfterSelect = false
         headlessMenuShowing = true
-        popup.show()
+        headlessMenu?.show()
+        headlessList?.let { list ->
+          list.show()
+          if (virtualizedSelectedIndex >= 0) list.setSelection(virtualizedSelectedIndex)
+        }
       }
     }
   }
 
   private fun handleHeadlessSelection(position: Int) {
-    val opt = options.getOrNull(position) ?: return
+    val opt = optionAt(position) ?: return
     Log.d(TAG, "handleHeadlessSelection pos=$position data=${opt.data}")
     selectedData = opt.data
+    if (isVirtualized()) virtualizedSelectedIndex = position
     onSelect?.invoke(position, opt.label, opt.data)
   }
 
@@ -700,6 +867,89 @@ class PCSelectionMenuView(context: Context) : FrameLayout(context), ReactScrollV
     }
   }
 
+  // ---- Virtualized options ----
+
+  private fun isVirtualized(): Boolean = virtualization == "enabled"
+
+  private fun optionCount(): Int =
+    if (isVirtualized()) optionProvider?.count ?: 0 else options.size
+
+  private fun optionAt(index: Int): Option? =
+    if (isVirtualized()) optionProvider?.optionAt(index) else options.getOrNull(index)
+
+  // Runs at mount time (after the props transaction), so C++ serves exactly
+  // the options this view received rather than a newer or discarded render.
+  private fun mountOptionProvider() {
+    val provider = optionProvider ?: PCSelectionMenuOptionProvider(id).also { optionProvider = it }
+    val mounted = provider.mount(optionsRevision)
+    Log.d(TAG, "mountOptionProvider revision=$optionsRevision mounted=$mounted count=${provider.count}")
+  }
+
+  private fun refreshVirtualizedAdapters() {
+    inlineText?.setAdapter(
+      VirtualizedOptionAdapter(
+        android.R.layout.simple_list_item_1,
+        android.R.layout.simple_list_item_1,
+        markSelected = false
+      )
+    )
+
+    inlineSpinner?.let { sp ->
+      suppressInlineSpinnerCallbacks(sp)
+      sp.adapter = VirtualizedOptionAdapter(
+        android.R.layout.simple_spinner_item,
+        android.R.layout.simple_spinner_dropdown_item,
+        markSelected = false
+      )
+    }
+
+    (headlessList?.listView?.adapter as? BaseAdapter)?.notifyDataSetChanged()
+
+    if (anchorMode == "inline") {
+      post { updateFrameSizeState() }
+    }
+  }
+
+  /**
+   * Adapter over [PCSelectionMenuOptionProvider]. ListView/Spinner only bind
+   * visible positions and recycle row views, so only those rows are fetched.
+   */
+  private inner class VirtualizedOptionAdapter(
+    private val itemLayout: Int,
+    private val dropDownLayout: Int,
+    private val markSelected: Boolean
+  ) : BaseAdapter(), Filterable {
+    override fun getCount(): Int = optionCount()
+
+    override fun getItem(position: Int): Any? = optionAt(position)?.label
+
+    override fun getItemId(position: Int): Long = position.toLong()
+
+    override fun getView(position: Int, convertView: View?, parent: ViewGroup): View =
+      bind(position, convertView, parent, itemLayout)
+
+    override fun getDropDownView(position: Int, convertView: View?, parent: ViewGroup): View =
+      bind(position, convertView, parent, dropDownLayout)
+
+    private fun bind(position: Int, convertView: View?, parent: ViewGroup, layout: Int): View {
+      val row = convertView ?: LayoutInflater.from(parent.context).inflate(layout, parent, false)
+      val label = optionAt(position)?.label ?: ""
+      (row as? TextView)?.text =
+        if (markSelected && position == virtualizedSelectedIndex) "✓ $label" else label
+      return row
+    }
+
+    // The inline text field is read-only, so "filtering" always yields every option.
+    override fun getFilter(): Filter = object : Filter() {
+      override fun performFiltering(constraint: CharSequence?): FilterResults =
+        FilterResults().apply { count = getCount() }
+
+      override fun publishResults(constraint: CharSequence?, results: FilterResults?) {
+        notifyDataSetChanged()
+      }
+    }
+  }
+
   private fun suppressInlineSpinnerCallbacks(sp: Spinner) {
     inlineSpinnerSuppressCount += 1
     val posted = sp.post {
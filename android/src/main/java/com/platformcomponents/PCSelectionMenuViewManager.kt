@@ -57,18 +57,29 @@ class PCSelectionMenuViewManager :
     }
   }
 
+  override fun onAfterUpdateTransaction(view: PCSelectionMenuView) {
+    super.onAfterUpdateTransaction(view)
+    view.commitOptions()
+  }
+
+  override fun onDropViewInstance(view: PCSelectionMenuView) {
+    view.releaseOptionProvider()
+    super.onDropViewInstance(view)
+  }
+
   // options: array of {label,data}
+  // Parsed by the view unless virtualized (then rows come from the C++ provider).
   override fun setOptions(view: PCSelectionMenuView, value: ReadableArray?) {
-    val out = ArrayList<PCSelectionMenuView.Option>()
-    if (value != null) {
-      for (i in 0 until value.size()) {
-        val m = value.getMap(i) ?: continue
-        val label = if (m.hasKey("label") && !m.isNull("label")) m.getString("label") ?: "" else ""
-        val data = if (m.hasKey("data") && !m.isNull("data")) m.getString("data") ?: "" else ""
-        out.add(PCSelectionMenuView.Option(label = label, data = data))
-      }
-    }
-    view.applyOptions(out)
+    view.applyOptionsSource(value)
+  }
+
+  override fun setOptionsRevision(view: PCSelectionMenuView, value: Int) {
+    view.applyOptionsRevision(value)
+  }
+
+  // virtualization: "enabled" | "disabled"
+  override fun setVirtualization(view: PCSelectionMenuView, value: String?) {
+    view.applyVirtualization(value)
   }
 
   override fun setSelectedData(view: PCSelectionMenuView, value: String?) {
@@ -0,0 +1,146 @@
+// JNI bridge for virtualized SelectionMenu options.
+// Kotlin side: com.platformcomponents.PCSelectionMenuOptionProvider
+
+#include <fbjni/fbjni.h>
+
+#include "PCSelectionMenuOptionProvider.h"
+
+using namespace facebook::react;
+namespace jni = facebook::jni;
+
+// NOTE: Option strings are standard UTF-8. Convert through fbjni
+// (make_jstring / toStdString), never NewStringUTF / GetStringUTFChars, which
+// use modified UTF-8 and break on 4-byte characters such as emoji.
+
+extern "C" JNIEXPORT jint JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeCount(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag) {
+  jint count = 0;
+  PCSelectionMenuOptionRegistry::shared().withProvider(
+      tag, [&](PCSelectionMenuOptionProvider& provider) {
+        count = static_cast<jint>(provider.count());
+      });
+  return count;
+}
+
+extern "C" JNIEXPORT jint JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeCapacity(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag) {
+  jint capacity = 0;
+  PCSelectionMenuOptionRegistry::shared().withProvider(
+      tag, [&](PCSelectionMenuOptionProvider& provider) {
+        capacity = static_cast<jint>(provider.capacity());
+      });
+  return capacity;
+}
+
+extern "C" JNIEXPORT jint JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeIndexOfData(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag,
+    jstring data) {
+  if (data == nullptr) return -1;
+  const std::string value = jni::wrap_alias(data)->toStdString();
+
+  jint index = -1;
+  PCSelectionMenuOptionRegistry::shared().withProvider(
+      tag, [&](PCSelectionMenuOptionProvider& provider) {
+        if (auto found = provider.indexOfData(value)) {
+          index = static_cast<jint>(*found);
+        }
+      });
+  return index;
+}
+
+// Makes `index` resident. Returns null if the row doesn't exist (no mounted
+// provider, or fewer options than `index`). Otherwise returns the rows that
+// had to be fetched, flattened as [label0, data0, label1, data1, ...] (empty
+// when `index` was already resident), and writes the first fetched index to
+// outLocation[0].
+extern "C" JNIEXPORT jobjectArray JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeRequestRow(
+    JNIEnv* env,
+    jclass /*clazz*/,
+    jint tag,
+    jint index,
+    jintArray outLocation) {
+  if (index < 0) return nullptr;
+
+  jni::local_ref<jni::JArrayClass<jstring>> rows;
+  PCSelectionMenuOptionRegistry::shared().withProvider(
+      tag, [&](PCSelectionMenuOptionProvider& provider) {
+        if (static_cast<size_t>(index) >= provider.count()) return;
+
+        const auto load = provider.requestRow(
+            static_cast<size_t>(index),
+            [](size_t, size_t, const PCSelectionMenuOptionsStruct&) {});
+
+        rows = jni::JArrayClass<jstring>::newArray(load.length * 2);
+        for (size_t i = 0; i < load.length; i++) {
+          const auto* opt = provider.optionAt(load.location + i);
+          rows->setElement(i * 2, *jni::make_jstring(opt->label));
+          rows->setElement(i * 2 + 1, *jni::make_jstring(opt->data));
+        }
+
+        const jint location = static_cast<jint>(load.location);
+        env->SetIntArrayRegion(outLocation, 0, 1, &location);
+      });
+  return rows.release();
+}
+
+// Returns every option of the mounted provider, flattened like
+// nativeRequestRow, or null if nothing is mounted. Only used when
+// virtualization is turned off and the view needs the full list again.
+extern "C" JNIEXPORT jobjectArray JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeReadAll(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag) {
+  jni::local_ref<jni::JArrayClass<jstring>> rows;
+  PCSelectionMenuOptionRegistry::shared().withProvider(
+      tag, [&](PCSelectionMenuOptionProvider& provider) {
+        const size_t count = provider.count();
+        rows = jni::JArrayClass<jstring>::newArray(count * 2);
+        for (size_t i = 0; i < count; i++) {
+          const auto* opt = provider.optionAt(i);
+          rows->setElement(i * 2, *jni::make_jstring(opt->label));
+          rows->setElement(i * 2 + 1, *jni::make_jstring(opt->data));
+        }
+      });
+  return rows.release();
+}
+
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeMount(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag,
+    jint revision) {
+  return PCSelectionMenuOptionRegistry::shared().mount(tag, revision)
+      ? JNI_TRUE
+      : JNI_FALSE;
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeInvalidate(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag) {
+  PCSelectionMenuOptionRegistry::shared().withProvider(
+      tag, [](PCSelectionMenuOptionProvider& provider) {
+        provider.invalidate();
+      });
+}
+
+extern "C" JNIEXPORT void JNICALL
+Java_com_platformcomponents_PCSelectionMenuOptionProvider_nativeRelease(
+    JNIEnv* /*env*/,
+    jclass /*clazz*/,
+    jint tag) {
+  PCSelectionMenuOptionRegistry::shared().release(tag);
+}
@@ -18,33 +18,32 @@
 #endif
 
 #import "PCSelectionMenuComponentDescriptors-custom.h"
+#import "PCSelectionMenuOptionProvider.h"
 #import "PCSelectionMenuShadowNode-custom.h"
 #import "PCSelectionMenuState-custom.h"
 
 using namespace facebook::react;
 
 namespace {
-static inline bool OptionsEqual(
-    const std::vector<facebook::react::PCSelectionMenuOptionsStruct> &a,
-    const std::vector<facebook::react::PCSelectionMenuOptionsStruct> &b) {
-  if (a.size() != b.size()) return false;
-  for (size_t i = 0; i < a.size(); i++) {
-    if (a[i].label != b[i].label) return false;
-    if (a[i].data != b[i].data) return false;
-  }
-  return true;
+static inline NSString *ToNSString(const std::string &value) {
+  return value.empty() ? @"" : [NSString stringWithUTF8String:value.c_str()];
 }
 } // namespace
 
 @interface PCSelectionMenu ()
 
 - (void)updateMeasurements;
+- (nullable NSDictionary<NSString *, NSString *> *)optionAtIndex:(NSInteger)index;
 
 @end
 
 @implementation PCSelectionMenu {
   PCSelectionMenuView *_view;
   MeasuringPCSelectionMenuShadowNode::ConcreteState::Shared _state;
+
+  // Virtualized option delivery: rows are converted on demand into recycled slots
+  PCSelectionMenuOptionProvider _optionProvider;
+  NSMutableArray *_optionSlots;
 }
 
 + (ComponentDescriptorProvider)componentDescriptorProvider {
@@ -59,6 +58,12 @@ static inline bool OptionsEqual(
 
     __weak __typeof(self) weakSelf = self;
 
+    _view.optionProvider = ^NSDictionary<NSString *, NSString *> *(NSInteger index) {
+      __typeof(self) strongSelf = weakSelf;
+      if (!strongSelf) return nil;
+      return [strongSelf optionAtIndex:index];
+    };
+
     _view.onSelect = ^(NSInteger index, NSString *label, NSString *data) {
       __typeof(self) strongSelf = weakSelf;
       if (!strongSelf) return;
@@ -104,18 +109,35 @@ static inline bool OptionsEqual(
   const auto prevProps =
       std::static_pointer_cast<const PCSelectionMenuProps>(oldProps);
 
-  // options: [{label,data}]
-  if (!prevProps || !OptionsEqual(newProps.options, prevProps->options)) {
+  // virtualization: "enabled" | "disabled"
+  const bool virtualized = newProps.virtualization == "enabled";
+  const bool virtualizationChanged =
+      !prevProps || newProps.virtualization != prevProps->virtualization;
+  if (virtualizationChanged) {
+    _view.virtualization = virtualized ? @"enabled" : @"disabled";
+  }
+
+  bool optionsChanged = virtualizationChanged;
+  if (virtualized) {
+    // Keep only a reference to the shadow-tree props; rows are fetched on scroll.
+    optionsChanged |= _optionProvider.setProps(
+        std::static_pointer_cast<const PCSelectionMenuProps>(props));
+    if (optionsChanged) {
+      _optionSlots = nil;
+      _view.options = @[];
+      _view.optionCount = (NSInteger)_optionProvider.count();
+    }
+  } else if (
+      virtualizationChanged ||
+      !PCSelectionMenuOptionsEqual(newProps.options, prevProps->options)) {
+    // options: [{label,data}]
+    _optionProvider.setProps(nullptr);
+    _optionSlots = nil;
     NSMutableArray *arr = [NSMutableArray new];
     for (const auto &opt : newProps.options) {
-      NSString *label = opt.label.empty()
-                            ? @""
-                            : [NSString stringWithUTF8String:opt.label.c_str()];
-      NSString *data = opt.data.empty()
-                           ? @""
-                           : [NSString stringWithUTF8String:opt.data.c_str()];
-      [arr addObject:@{@"label" : label, @"data" : data}];
+      [arr addObject:@{@"label" : ToNSString(opt.label), @"data" : ToNSString(opt.data)}];
     }
+    _view.optionCount = 0;
     _view.options = arr;
   }
 
@@ -129,6 +151,15 @@ static inline bool OptionsEqual(
     }
   }
 
+  // Virtualized views can't scan options for the selected label; resolve it here.
+  if (!virtualized) {
+    if (virtualizationChanged) _view.selectedLabel = nil;
+  } else if (optionsChanged || newProps.selectedData != prevProps->selectedData) {
+    const auto index = _optionProvider.indexOfData(newProps.selectedData);
+    _view.selectedLabel =
+        index ? ToNSString(_optionProvider.optionAt(*index)->label) : nil;
+  }
+
   // interactivity: "enabled" | "disabled"
   if (!prevProps || newProps.interactivity != prevProps->interactivity) {
     if (!newProps.interactivity.empty()) {
@@ -187,6 +218,43 @@ static inline bool OptionsEqual(
   [self updateMeasurements];
 }
 
+- (void)prepareForRecycle {
+  // Pooled views must not keep the shadow-tree options or converted rows alive.
+  _optionProvider.setProps(nullptr);
+  _optionSlots = nil;
+  _view.optionCount = 0;
+  _view.selectedLabel = nil;
+
+  [super prepareForRecycle];
+}
+
+#pragma mark - Virtualized options
+
+- (nullable NSDictionary<NSString *, NSString *> *)optionAtIndex:(NSInteger)index {
+  if (index < 0 || (size_t)index >= _optionProvider.count())
+    return nil;
+
+  if (_optionSlots == nil) {
+    const size_t capacity = _optionProvider.capacity();
+    _optionSlots = [NSMutableArray arrayWithCapacity:capacity];
+    for (size_t i = 0; i < capacity; i++) {
+      [_optionSlots addObject:[NSNull null]];
+    }
+    _optionProvider.invalidate();
+  }
+
+  // Convert only the rows that entered the window, reusing evicted slots.
+  NSMutableArray *slots = _optionSlots;
+  _optionProvider.requestRow(
+      (size_t)index,
+      [slots](size_t, size_t slot, const PCSelectionMenuOptionsStruct &opt) {
+        slots[slot] = @{@"label" : ToNSString(opt.label), @"data" : ToNSString(opt.data)};
+      });
+
+  id row = _optionSlots[(NSUInteger)index % _optionSlots.count];
+  return [row isKindOfClass:[NSDictionary class]] ? row : nil;
+}
+
 #pragma mark - State (Measuring)
 
 - (void)updateState:(const State::Shared &)state
@@ -10,6 +10,12 @@ struct PCSelectionMenuOption {
     let data: String
 }
 
+/// Count + row lookup handed to the popover, so it never needs the full option list.
+struct PCSelectionMenuOptionSource {
+    let count: Int
+    let optionAt: (Int) -> PCSelectionMenuOption?
+}
+
 @objcMembers
 public final class PCSelectionMenuView: UIControl {
     // MARK: - Props (set from ObjC++)
@@ -39,6 +45,21 @@ public final class PCSelectionMenuView: UIControl {
     /// Android material preference (ignored on iOS; retained for debugging/log parity)
     public var androidMaterial: String? = nil
 
+    // MARK: - Virtualized options (set from ObjC++)
+
+    /// "enabled" | "disabled". When enabled, `options` stays empty and rows are
+    /// pulled through `optionProvider` as they scroll into view.
+    public var virtualization: String = "disabled" { didSet { sync() } }
+
+    /// Total option count (virtualized only)
+    public var optionCount: Int = 0 { didSet { sync() } }
+
+    /// Label for `selectedData`, resolved natively (virtualized only)
+    public var selectedLabel: String? { didSet { sync() } }
+
+    /// Returns {label,data} for a row index (virtualized only)
+    public var optionProvider: ((Int) -> [String: String]?)?
+
     // MARK: - Events back to ObjC++
 
     public var onSelect: ((Int, String, String) -> Void)?  // (index,label,data)
@@ -54,6 +75,12 @@ public final class PCSelectionMenuView: UIControl {
     private var headlessMenuVC: UIViewController?
     private var headlessPresentationToken: Int = 0
 
+    // MARK: - Internal (virtualized inline popover)
+
+    private var inlineMenuVC: UIViewController?
+
+    private var isVirtualized: Bool { virtualization == "enabled" }
+
     private var parsedOptions: [PCSelectionMenuOption] {
         options.compactMap { any in
             guard let dict = any as? [String: Any] else { return nil }
@@ -64,6 +91,12 @@ public final class PCSelectionMenuView: UIControl {
     }
 
     private var displayTitle: String {
+        if isVirtualized {
+            if !selectedData.isEmpty, let label = selectedLabel {
+                return label
+            }
+            return placeholder ?? "Select"
+        }
         let opts = parsedOptions
         if !selectedData.isEmpty, let opt = opts.first(where: { $0.data == selectedData }) {
             return opt.label
@@ -90,6 +123,30 @@ public final class PCSelectionMenuView: UIControl {
         sync()
     }
 
+    /// Virtualized: rows come from ObjC++ on demand.
+    /// Eager: a snapshot of the parsed options.
+    private func makeOptionSource() -> PCSelectionMenuOptionSource {
+        if isVirtualized {
+            let provider = optionProvider
+            return PCSelectionMenuOptionSource(count: optionCount) { index in
+                guard let dict = provider?(index) else { return nil }
+                return PCSelectionMenuOption(label: dict["label"] ?? "", data: dict["data"] ?? "")
+            }
+        }
+        let opts = parsedOptions
+        return PCSelectionMenuOptionSource(count: opts.count) { index in
+            opts.indices.contains(index) ? opts[index] : nil
+        }
+    }
+
+    private func applyUserSelection(index: Int, option: PCSelectionMenuOption) {
+        if isVirtualized {
+            selectedLabel = option.label
+        }
+        selectedData = option.data
+        onSelect?(index, option.label, option.data)
+    }
+
     private func updateEnabled() {
         let disabled = (interactivity == "disabled")
         alpha = disabled ? 0.5 : 1.0
@@ -97,6 +154,7 @@ public final class PCSelectionMenuView: UIControl {
         accessibilityTraits = disabled ? [.notEnabled] : [.button]
         if disabled {
             dismissHeadlessIfNeeded()
+            dismissInlineMenuIfNeeded()
         }
     }
 
@@ -144,6 +202,10 @@ public final class PCSelectionMenuView: UIControl {
         let button = UIButton(configuration: config)
         button.showsMenuAsPrimaryAction = true
         button.changesSelectionAsPrimaryAction = false
+        // Virtualized: a UIMenu would need every option, so present the popover instead
+        button.addAction(UIAction { [weak self] _ in
+            self?.presentInlineMenuIfNeeded()
+        }, for: .primaryActionTriggered)
 
         addSubview(button)
         menuButton = button
@@ -153,19 +215,25 @@ public final class PCSelectionMenuView: UIControl {
     }
 
     private func uninstallInlineIfNeeded() {
+        dismissInlineMenuIfNeeded()
         guard let button = menuButton else { return }
         button.removeFromSuperview()
         menuButton = nil
     }
 
     private func rebuildMenu() {
+        if isVirtualized {
+            menuButton?.showsMenuAsPrimaryAction = false
+            menuButton?.menu = nil
+            return
+        }
+        menuButton?.showsMenuAsPrimaryAction = true
+
         let opts = parsedOptions
         let disabled = (interactivity == "disabled") || opts.isEmpty
         let actions = opts.enumerated().map { (idx, opt) in
             UIAction(title: opt.label) { [weak self] _ in
-                guard let self else { return }
-                self.selectedData = opt.data
-                self.onSelect?(idx, opt.label, opt.data)
+                self?.applyUserSelection(index: idx, option: opt)
             }
         }
         menuButton?.menu = disabled ? nil : UIMenu(children: actions)
@@ -243,10 +311,10 @@ public final class PCSelectionMenuView: UIControl {
         guard headlessMenuView != nil else { return }
         guard let vc = nearestViewController() else { return }
 
-        let opts = parsedOptions
-        guard !opts.isEmpty else { return }
+        let source = makeOptionSource()
+        guard source.count > 0 else { return }
 
-        logger.debug("presentHeadlessMenuIfNeeded: scheduling presentation with \(opts.count) options")
+        logger.debug("presentHeadlessMenuIfNeeded: scheduling presentation with \(source.count) options")
         DispatchQueue.main.asyncAfter(deadline: .now() + PCConstants.headlessPresentationDelay) { [weak self] in
             guard let self else { return }
             guard self.headlessPresentationToken == token else { return }
@@ -257,13 +325,11 @@ public final class PCSelectionMenuView: UIControl {
             guard self.window != nil else { return }
 
             let menuVC = PCMenuViewController(
-                options: opts,
+                source: source,
                 onSelect: { [weak self] idx in
-                    guard let self else { return }
-                    let opt = opts[idx]
+                    guard let self, let opt = source.optionAt(idx) else { return }
                     logger.debug("headless menu selected: index=\(idx), data=\(opt.data)")
-                    self.selectedData = opt.data
-                    self.onSelect?(idx, opt.label, opt.data)
+                    self.applyUserSelection(index: idx, option: opt)
                 },
                 onCancel: { [weak self] in
                     logger.debug("headless menu cancelled")
@@ -274,46 +340,85 @@ public final class PCSelectionMenuView: UIControl {
                 }
             )
 
-            // Calculate menu position relative to source view
-            let sourceFrame = self.convert(self.bounds, to: vc.view)
-            let screenBounds = vc.view.bounds
-            let popoverHeight = min(
-                CGFloat(opts.count) * PCConstants.popoverRowHeight + PCConstants.popoverVerticalPadding,
-                PCConstants.popoverMaxHeight
-            )
-            let spacing: CGFloat = 8
-
-            // Check if menu fits below the source view
-            let rowHeight = PCConstants.popoverRowHeight
-            let wouldExtendBeyondBottom = sourceFrame.maxY + spacing + popoverHeight > screenBounds.maxY - 20
-
-            let menuY: CGFloat
-            if wouldExtendBeyondBottom {
-                // Position above the source view (no overlap offset)
-                menuY = sourceFrame.minY - spacing - popoverHeight
-            } else {
-                // Position below, but shift up by one row to overlap trigger (like system menu)
-                menuY = sourceFrame.maxY + spacing - rowHeight
+            self.headlessMenuVC = menuVC
+            self.presentMenu(menuVC, optionCount: source.count, in: vc)
+        }
+    }
+
+    // MARK: - Virtualized inline presentation
+
+    private func presentInlineMenuIfNeeded() {
+        guard isVirtualized, anchorMode == "inline" else { return }
+        guard interactivity != "disabled" else { return }
+        guard inlineMenuVC == nil, window != nil else { return }
+        guard let vc = nearestViewController() else { return }
+
+        let source = makeOptionSource()
+        guard source.count > 0 else { return }
+
+        let menuVC = PCMenuViewController(
+            source: source,
+            onSelect: { [weak self] idx in
+                guard let self, let opt = source.optionAt(idx) else { return }
+                logger.debug("inline menu selected: index=\(idx), data=\(opt.data)")
+                self.applyUserSelection(index: idx, option: opt)
+            },
+            onCancel: {},
+            onDismiss: { [weak self] in
+                self?.inlineMenuVC = nil
             }
+        )
 
-            // Center horizontally, but keep within screen bounds
-            var menuX = sourceFrame.midX - PCConstants.popoverWidth / 2
-            menuX = max(16, min(menuX, screenBounds.maxX - PCConstants.popoverWidth - 16))
+        inlineMenuVC = menuVC
+        presentMenu(menuVC, optionCount: source.count, in: vc)
+    }
 
-            let menuFrame = CGRect(
-                x: menuX,
-                y: menuY,
-                width: PCConstants.popoverWidth,
-                height: popoverHeight
-            )
+    private func dismissInlineMenuIfNeeded() {
+        guard let vc = inlineMenuVC else { return }
+        inlineMenuVC = nil
+        vc.dismiss(animated: true)
+    }
+
+    /// Positions the popover next to this view (like the system menu) and presents it.
+    private func presentMenu(_ menuVC: PCMenuViewController, optionCount: Int, in vc: UIViewController) {
+        // Calculate menu position relative to source view
+        let sourceFrame = convert(bounds, to: vc.view)
+        let screenBounds = vc.view.bounds
+        let popoverHeight = min(
+            CGFloat(optionCount) * PCConstants.popoverRowHeight + PCConstants.popoverVerticalPadding,
+            PCConstants.popoverMaxHeight
+        )
+        let spacing: CGFloat = 8
 
-            menuVC.modalPresentationStyle = .overCurrentContext
-            menuVC.modalTransitionStyle = .crossDissolve
-            menuVC.menuFrame = menuFrame
+        // Check if menu fits below the source view
+        let rowHeight = PCConstants.popoverRowHeight
+        let wouldExtendBeyondBottom = sourceFrame.maxY + spacing + popoverHeight > screenBounds.maxY - 20
 
-            self.headlessMenuVC = menuVC
-            vc.present(menuVC, animated: true)
+        let menuY: CGFloat
+        if wouldExtendBeyondBottom {
+            // Position above the source view (no overlap offset)
+            menuY = sourceFrame.minY - spacing - popoverHeight
+        } else {
+            // Position below, but shift up by one row to overlap trigger (like system menu)
+            menuY = sourceFrame.maxY + spacing - rowHeight
         }
+
+        // Center horizontally, but keep within screen bounds
+        var menuX = sourceFrame.midX - PCConstants.popoverWidth / 2
+        menuX = max(16, min(menuX, screenBounds.maxX - PCConstants.popoverWidth - 16))
+
+        let menuFrame = CGRect(
+            x: menuX,
+            y: menuY,
+            width: PCConstants.popoverWidth,
+            height: popoverHeight
+        )
+
+        menuVC.modalPresentationStyle = .overCurrentContext
+        menuVC.modalTransitionStyle = .crossDissolve
+        menuVC.menuFrame = menuFrame
+
+        vc.present(menuVC, animated: true)
     }
 
     // MARK: - Sizing
@@ -387,7 +492,7 @@ private class PCGlassMenuCell: UITableViewCell {
 // MARK: - Custom Menu View Controller (matches SwiftUI Menu appearance)
 
 private class PCMenuViewController: UIViewController, UITableViewDelegate, UITableViewDataSource {
-    private let options: [PCSelectionMenuOption]
+    private let source: PCSelectionMenuOptionSource
     private let onSelect: (Int) -> Void
     private let onCancel: () -> Void
     private let onDismiss: () -> Void
@@ -397,12 +502,12 @@ private class PCMenuViewController: UIViewController, UITableViewDelegate, UITab
     var menuFrame: CGRect = .zero
 
     init(
-        options: [PCSelectionMenuOption],
+        source: PCSelectionMenuOptionSource,
         onSelect: @escaping (Int) -> Void,
         onCancel: @escaping () -> Void,
         onDismiss: @escaping () -> Void
     ) {
-        self.options = options
+        self.source = source
         self.onSelect = onSelect
         self.onCancel = onCancel
         self.onDismiss = onDismiss
@@ -474,12 +579,13 @@ private class PCMenuViewController: UIViewController, UITableViewDelegate, UITab
     }
 
     func tableView(_ tableView: UITableView, numberOfRowsInSection section: Int) -> Int {
-        return options.count
+        return source.count
     }
 
     func tableView(_ tableView: UITableView, cellForRowAt indexPath: IndexPath) -> UITableViewCell {
         let cell = tableView.dequeueReusableCell(withIdentifier: PCGlassMenuCell.reuseIdentifier, for: indexPath)
-        cell.textLabel?.text = options[indexPath.row].label
+        // Rows are fetched lazily; cells are reused, so only visible rows are ever resolved
+        cell.textLabel?.text = source.optionAt(indexPath.row)?.label
         return cell
     }
 
@@ -10,13 +10,39 @@ class MeasuringPCSelectionMenuShadowNode;
 // Include the actual shadow node definition
 #include "PCSelectionMenuShadowNode-custom.h"
 
+#ifdef __ANDROID__
+#include "PCSelectionMenuOptionProvider.h"
+#endif
+
 namespace facebook::react {
 
 /**
  * Custom component descriptor that uses our measuring shadow node
  * instead of the generated one.
+ *
+ * On Android it also publishes virtualized props to the option registry so
+ * the Kotlin view can fetch rows over JNI once mounted (iOS reads props in
+ * updateProps).
  */
-using MeasuringPCSelectionMenuComponentDescriptor =
-    ConcreteComponentDescriptor<MeasuringPCSelectionMenuShadowNode>;
+class MeasuringPCSelectionMenuComponentDescriptor final
+    : public ConcreteComponentDescriptor<MeasuringPCSelectionMenuShadowNode> {
+ public:
+  using ConcreteComponentDescriptor::ConcreteComponentDescriptor;
+
+ protected:
+  void adopt(ShadowNode& shadowNode) const override {
+    ConcreteComponentDescriptor::adopt(shadowNode);
+
+#ifdef __ANDROID__
+    auto props = std::static_pointer_cast<const PCSelectionMenuProps>(
+        shadowNode.getProps());
+    if (props->virtualization == "enabled") {
+      // Pending only: the Kotlin view mounts the revision it receives.
+      PCSelectionMenuOptionRegistry::shared().publish(
+          shadowNode.getTag(), props->optionsRevision, props);
+    }
+#endif
+  }
+};
 
 } // namespace facebook::react
@@ -0,0 +1,141 @@
+#include "PCSelectionMenuOptionProvider.h"
+
+namespace facebook::react {
+
+bool PCSelectionMenuOptionsEqual(
+    const std::vector<PCSelectionMenuOptionsStruct>& a,
+    const std::vector<PCSelectionMenuOptionsStruct>& b) {
+  if (&a == &b) return true;
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i].label != b[i].label) return false;
+    if (a[i].data != b[i].data) return false;
+  }
+  return true;
+}
+
+PCSelectionMenuOptionProvider::PCSelectionMenuOptionProvider(
+    size_t visibleRows,
+    size_t prefetch)
+    : window_(visibleRows, prefetch) {}
+
+bool PCSelectionMenuOptionProvider::setProps(
+    std::shared_ptr<const PCSelectionMenuProps> props) {
+  const bool changed = !props_ || !props ||
+      !PCSelectionMenuOptionsEqual(props_->options, props->options);
+  props_ = std::move(props);
+  if (changed) {
+    invalidate();
+  }
+  return changed;
+}
+
+void PCSelectionMenuOptionProvider::invalidate() {
+  window_.reset(count());
+}
+
+size_t PCSelectionMenuOptionProvider::count() const {
+  return props_ ? props_->options.size() : 0;
+}
+
+const PCSelectionMenuOptionProvider::Option*
+PCSelectionMenuOptionProvider::optionAt(size_t index) const {
+  if (index >= count()) return nullptr;
+  return &props_->options[index];
+}
+
+std::optional<size_t> PCSelectionMenuOptionProvider::indexOfData(
+    const std::string& data) const {
+  if (!props_ || data.empty()) return std::nullopt;
+  const auto& options = props_->options;
+  for (size_t i = 0; i < options.size(); i++) {
+    if (options[i].data == data) return i;
+  }
+  return std::nullopt;
+}
+
+PCSelectionMenuOptionRange PCSelectionMenuOptionProvider::requestRow(
+    size_t index,
+    const RowVisitor& visitor) {
+  if (index >= count()) return {};
+
+  const auto update = window_.touch(index);
+  for (size_t i = update.load.location; i < update.load.end(); i++) {
+    visitor(i, window_.slotFor(i), props_->options[i]);
+  }
+  return update.load;
+}
+
+PCSelectionMenuOptionRegistry& PCSelectionMenuOptionRegistry::shared() {
+  static PCSelectionMenuOptionRegistry registry;
+  return registry;
+}
+
+void PCSelectionMenuOptionRegistry::publish(
+    Tag tag,
+    int32_t revision,
+    const std::shared_ptr<const PCSelectionMenuProps>& props) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  sweepLocked();
+  entries_[tag].pending[revision] = props;
+}
+
+bool PCSelectionMenuOptionRegistry::mount(Tag tag, int32_t revision) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(tag);
+  if (it == entries_.end()) return false;
+
+  auto& entry = it->second;
+  auto pending = entry.pending.find(revision);
+  auto props = pending != entry.pending.end() ? pending->second.lock() : nullptr;
+  if (!props && entry.mounted && entry.mountedRevision == revision) {
+    // Re-mounting what is already mounted (e.g. virtualization toggled).
+    return true;
+  }
+  if (!props) {
+    entry.mounted.reset();
+    sweepLocked();
+    return false;
+  }
+
+  if (!entry.mounted) entry.mounted.emplace();
+  entry.mounted->setProps(std::move(props));
+  entry.mountedRevision = revision;
+
+  // Older revisions can no longer mount.
+  entry.pending.erase(entry.pending.begin(), std::next(pending));
+  return true;
+}
+
+void PCSelectionMenuOptionRegistry::release(Tag tag) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.erase(tag);
+}
+
+bool PCSelectionMenuOptionRegistry::withProvider(
+    Tag tag,
+    const std::function<void(PCSelectionMenuOptionProvider&)>& fn) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(tag);
+  if (it == entries_.end() || !it->second.mounted) return false;
+  fn(*it->second.mounted);
+  return true;
+}
+
+size_t PCSelectionMenuOptionRegistry::size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+void PCSelectionMenuOptionRegistry::sweepLocked() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto& pending = it->second.pending;
+    for (auto p = pending.begin(); p != pending.end();) {
+      p = p->second.expired() ? pending.erase(p) : std::next(p);
+    }
+    it = (pending.empty() && !it->second.mounted) ? entries_.erase(it)
+                                                   : std::next(it);
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <react/renderer/components/PlatformComponentsViewSpec/Props.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "PCSelectionMenuOptionWindow.h"
+
+namespace facebook::react {
+
+/**
+ * Compares options by label and data (codegen structs have no operator==).
+ */
+bool PCSelectionMenuOptionsEqual(
+    const std::vector<PCSelectionMenuOptionsStruct>& a,
+    const std::vector<PCSelectionMenuOptionsStruct>& b);
+
+/**
+ * Serves SelectionMenu options to native a window at a time when
+ * `virtualization` is "enabled".
+ *
+ * Key behavior:
+ * - Holds the shadow-tree props (immutable, shared) instead of copying options
+ * - Native only learns the option count up front and asks for rows as they
+ *   scroll into view; the window decides which rows must be converted
+ * - Native keeps converted rows in `capacity()` recycled slots
+ */
+class PCSelectionMenuOptionProvider {
+ public:
+  using Option = PCSelectionMenuOptionsStruct;
+
+  // Called for each row that became resident: (index, slot, option)
+  using RowVisitor =
+      std::function<void(size_t index, size_t slot, const Option& option)>;
+
+  explicit PCSelectionMenuOptionProvider(
+      size_t visibleRows = PCSelectionMenuOptionWindow::kDefaultVisibleRows,
+      size_t prefetch = PCSelectionMenuOptionWindow::kDefaultPrefetch);
+
+  /**
+   * Adopts new props. Returns true (and drops resident rows) when the options
+   * differ from the previous props.
+   */
+  bool setProps(std::shared_ptr<const PCSelectionMenuProps> props);
+
+  /**
+   * Drops resident rows so the next request refetches them.
+   */
+  void invalidate();
+
+  size_t count() const;
+
+  size_t capacity() const {
+    return window_.capacity();
+  }
+
+  const Option* optionAt(size_t index) const;
+
+  std::optional<size_t> indexOfData(const std::string& data) const;
+
+  /**
+   * Makes `index` resident, visiting every row that had to be fetched.
+   * Returns the rows that were fetched (empty when already resident).
+   */
+  PCSelectionMenuOptionRange requestRow(
+      size_t index,
+      const RowVisitor& visitor);
+
+ private:
+  std::shared_ptr<const PCSelectionMenuProps> props_;
+  PCSelectionMenuOptionWindow window_;
+};
+
+/**
+ * Android only: lets the Kotlin view pull rows for its react tag over JNI.
+ *
+ * Key behavior:
+ * - The component descriptor publishes every virtualized shadow node's props
+ *   as *pending*, keyed by `optionsRevision`, holding them weakly so renders
+ *   that never mount don't keep their options alive
+ * - The Kotlin view mounts the revision it actually received; only then does
+ *   the tag get a provider (holding the props strongly)
+ * - Mounted providers live until the view is dropped (release)
+ */
+class PCSelectionMenuOptionRegistry {
+ public:
+  static PCSelectionMenuOptionRegistry& shared();
+
+  void publish(
+      Tag tag,
+      int32_t revision,
+      const std::shared_ptr<const PCSelectionMenuProps>& props);
+
+  /**
+   * Switches the tag's provider to the props published for `revision`.
+   * Returns false if those props are gone (the tag then has no provider).
+   */
+  bool mount(Tag tag, int32_t revision);
+
+  void release(Tag tag);
+
+  /**
+   * Runs `fn` with the mounted provider for `tag` under the registry lock.
+   * Returns false if nothing is mounted for the tag.
+   */
+  bool withProvider(
+      Tag tag,
+      const std::function<void(PCSelectionMenuOptionProvider&)>& fn);
+
+  size_t size();
+
+ private:
+  struct Entry {
+    std::map<int32_t, std::weak_ptr<const PCSelectionMenuProps>> pending;
+    std::optional<PCSelectionMenuOptionProvider> mounted;
+    int32_t mountedRevision{0};
+  };
+
+  // Drops pending props whose shadow nodes are gone, and empty entries.
+  void sweepLocked();
+
+  std::mutex mutex_;
+  std::unordered_map<Tag, Entry> entries_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+// NOTE: This header is intentionally free of React Native dependencies so the
+// range/prefetch logic can be unit tested on the host (see __tests__).
+
+namespace facebook::react {
+
+/**
+ * Half-open range of option indices: [location, location + length).
+ */
+struct PCSelectionMenuOptionRange {
+  size_t location{0};
+  size_t length{0};
+
+  size_t end() const {
+    return location + length;
+  }
+
+  bool empty() const {
+    return length == 0;
+  }
+
+  bool contains(size_t index) const {
+    return index >= location && index < end();
+  }
+
+  bool contains(const PCSelectionMenuOptionRange& other) const {
+    return other.location >= location && other.end() <= end();
+  }
+
+  bool operator==(const PCSelectionMenuOptionRange& other) const {
+    return location == other.location && length == other.length;
+  }
+
+  bool operator!=(const PCSelectionMenuOptionRange& other) const {
+    return !(*this == other);
+  }
+};
+
+/**
+ * Tracks which options are resident in native row storage while a virtualized
+ * SelectionMenu scrolls.
+ *
+ * Key behavior:
+ * - The resident range is the visible rows plus a prefetch window on each side,
+ *   so its size (capacity) is fixed and native storage is allocated once
+ * - Rows map to storage slots by `index % capacity`; rows that scroll in reuse
+ *   the slots of rows that scrolled out
+ * - The window only moves once the visible rows come within half a prefetch
+ *   window of its edge, so small scrolls never trigger a fetch
+ */
+class PCSelectionMenuOptionWindow {
+ public:
+  // Rows visible in a popover (~15 on both platforms)
+  static constexpr size_t kDefaultVisibleRows = 16;
+
+  // Rows fetched ahead of / behind the visible rows
+  static constexpr size_t kDefaultPrefetch = 8;
+
+  struct Update {
+    // Rows resident after the update
+    PCSelectionMenuOptionRange resident;
+
+    // Rows that became resident and must be fetched into their slots
+    PCSelectionMenuOptionRange load;
+  };
+
+  explicit PCSelectionMenuOptionWindow(
+      size_t visibleRows = kDefaultVisibleRows,
+      size_t prefetch = kDefaultPrefetch)
+      : capacity_(std::max<size_t>(visibleRows, 1) + 2 * prefetch),
+        margin_(prefetch / 2) {}
+
+  /**
+   * Drops all resident rows, e.g. when the options change.
+   */
+  void reset(size_t itemCount) {
+    itemCount_ = itemCount;
+    resident_ = {};
+  }
+
+  size_t itemCount() const {
+    return itemCount_;
+  }
+
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  const PCSelectionMenuOptionRange& resident() const {
+    return resident_;
+  }
+
+  size_t slotFor(size_t index) const {
+    return index % capacity_;
+  }
+
+  /**
+   * Reports the rows currently on screen. Returns the new resident range and
+   * the rows that must be fetched (empty when nothing moved).
+   */
+  Update update(PCSelectionMenuOptionRange visible) {
+    if (itemCount_ == 0) {
+      resident_ = {};
+      return {};
+    }
+
+    // Clamp the visible rows to the data and to what the window can hold.
+    visible.location = std::min(visible.location, itemCount_ - 1);
+    visible.length = std::clamp<size_t>(
+        visible.length, 1, std::min(capacity_, itemCount_ - visible.location));
+
+    if (!needsMove(visible)) {
+      return {resident_, {}};
+    }
+
+    // Center the window on the visible rows, then slide it back inside the data.
+    const size_t length = std::min(capacity_, itemCount_);
+    const size_t extra = length - visible.length;
+    size_t location =
+        visible.location > extra / 2 ? visible.location - extra / 2 : 0;
+    location = std::min(location, itemCount_ - length);
+
+    const PCSelectionMenuOptionRange previous = resident_;
+    resident_ = {location, length};
+    return {resident_, difference(resident_, previous)};
+  }
+
+  /**
+   * Convenience for adapters that only see one row at a time.
+   */
+  Update touch(size_t index) {
+    return update({index, 1});
+  }
+
+ private:
+  bool needsMove(const PCSelectionMenuOptionRange& visible) const {
+    if (resident_.empty() || !resident_.contains(visible)) {
+      return true;
+    }
+    const bool atStart = resident_.location == 0;
+    const bool atEnd = resident_.end() == itemCount_;
+    const bool nearStart = visible.location - resident_.location < margin_;
+    const bool nearEnd = resident_.end() - visible.end() < margin_;
+    return (nearStart && !atStart) || (nearEnd && !atEnd);
+  }
+
+  // Rows in `next` that are not in `previous`. Both ranges have the same
+  // length (fixed capacity), so the difference is always one contiguous run.
+  static PCSelectionMenuOptionRange difference(
+      const PCSelectionMenuOptionRange& next,
+      const PCSelectionMenuOptionRange& previous) {
+    if (previous.empty() || next.location >= previous.end() ||
+        previous.location >= next.end()) {
+      return next;
+    }
+    if (next.location < previous.location) {
+      return {next.location, previous.location - next.location};
+    }
+    return {previous.end(), next.end() - previous.end()};
+  }
+
+  size_t capacity_;
+  size_t margin_;
+  size_t itemCount_{0};
+  PCSelectionMenuOptionRange resident_{};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,191 @@
+#include "PCSelectionMenuOptionProvider.h"
+
+#include <vector>
+
+#include "TestHarness.h"
+
+using namespace facebook::react;
+
+namespace {
+
+std::shared_ptr<const PCSelectionMenuProps> makeProps(
+    size_t count,
+    const std::string& prefix = "item",
+    int revision = 0) {
+  auto props = std::make_shared<PCSelectionMenuProps>();
+  props->virtualization = "enabled";
+  props->optionsRevision = revision;
+  for (size_t i = 0; i < count; i++) {
+    props->options.push_back(
+        {prefix + " " + std::to_string(i), prefix + "-" + std::to_string(i)});
+  }
+  return props;
+}
+
+struct Fetched {
+  size_t index;
+  size_t slot;
+  std::string data;
+};
+
+std::vector<Fetched> request(
+    PCSelectionMenuOptionProvider& provider,
+    size_t index,
+    PCSelectionMenuOptionRange* load = nullptr) {
+  std::vector<Fetched> fetched;
+  const auto range = provider.requestRow(
+      index, [&](size_t i, size_t slot, const PCSelectionMenuOptionsStruct& opt) {
+        fetched.push_back({i, slot, opt.data});
+      });
+  if (load) *load = range;
+  return fetched;
+}
+
+void testSetPropsDetectsChanges() {
+  PCSelectionMenuOptionProvider provider;
+  EXPECT(provider.setProps(makeProps(100)));
+  EXPECT(provider.count() == 100);
+
+  // Same options in a new props object (e.g. another prop changed).
+  EXPECT(!provider.setProps(makeProps(100)));
+
+  // Same size, different content.
+  EXPECT(provider.setProps(makeProps(100, "other")));
+
+  // Different size.
+  EXPECT(provider.setProps(makeProps(50, "other")));
+  EXPECT(provider.count() == 50);
+
+  EXPECT(provider.setProps(nullptr));
+  EXPECT(provider.count() == 0);
+}
+
+void testVisitorSlotsMatchWindow() {
+  PCSelectionMenuOptionProvider provider;
+  provider.setProps(makeProps(50000));
+
+  for (size_t index : {0u, 100u, 1000u, 25000u, 49999u}) {
+    PCSelectionMenuOptionRange load;
+    const auto fetched = request(provider, index, &load);
+
+    // Each jump makes a fresh window around `index` resident.
+    EXPECT(load.contains(index));
+    EXPECT(load.length <= provider.capacity());
+    EXPECT(fetched.size() == load.length);
+    for (const auto& row : fetched) {
+      EXPECT(load.contains(row.index));
+      EXPECT(row.slot == row.index % provider.capacity());
+      EXPECT(row.data == "item-" + std::to_string(row.index));
+    }
+  }
+}
+
+void testUnchangedOptionsFetchNothing() {
+  PCSelectionMenuOptionProvider provider;
+  provider.setProps(makeProps(1000));
+  EXPECT(!request(provider, 10).empty());
+  EXPECT(request(provider, 10).empty());
+
+  // New props object with the same options keeps resident rows.
+  EXPECT(!provider.setProps(makeProps(1000)));
+  EXPECT(request(provider, 10).empty());
+
+  // Changed options refetch.
+  EXPECT(provider.setProps(makeProps(1000, "other")));
+  const auto fetched = request(provider, 10);
+  EXPECT(!fetched.empty());
+  EXPECT(!fetched.empty() && fetched.front().data.rfind("other-", 0) == 0);
+}
+
+void testOutOfRangeRowsFetchNothing() {
+  PCSelectionMenuOptionProvider provider;
+  EXPECT(request(provider, 0).empty());
+  EXPECT(provider.optionAt(0) == nullptr);
+
+  provider.setProps(makeProps(5));
+  EXPECT(request(provider, 5).empty());
+  EXPECT(provider.optionAt(5) == nullptr);
+  EXPECT(provider.indexOfData("item-4") == 4u);
+  EXPECT(!provider.indexOfData("missing").has_value());
+  EXPECT(!provider.indexOfData("").has_value());
+}
+
+void testRegistryServesOnlyMountedRevision() {
+  PCSelectionMenuOptionRegistry registry;
+  const Tag tag = 7;
+  auto rev1 = makeProps(10, "one", 1);
+  auto rev2 = makeProps(20, "two", 2);
+
+  registry.publish(tag, 1, rev1);
+  registry.publish(tag, 2, rev2);
+
+  // Nothing is served before the view mounts.
+  EXPECT(!registry.withProvider(tag, [](auto&) {}));
+
+  EXPECT(registry.mount(tag, 1));
+  size_t count = 0;
+  registry.withProvider(tag, [&](auto& provider) { count = provider.count(); });
+  EXPECT(count == 10);
+
+  // Re-mounting the same revision keeps the provider.
+  EXPECT(registry.mount(tag, 1));
+
+  EXPECT(registry.mount(tag, 2));
+  registry.withProvider(tag, [&](auto& provider) { count = provider.count(); });
+  EXPECT(count == 20);
+
+  registry.release(tag);
+  EXPECT(!registry.withProvider(tag, [](auto&) {}));
+  EXPECT(registry.size() == 0);
+}
+
+void testRegistryDropsRendersThatNeverMount() {
+  PCSelectionMenuOptionRegistry registry;
+  std::weak_ptr<const PCSelectionMenuProps> observed;
+  {
+    auto abandoned = makeProps(1000, "abandoned", 1);
+    observed = abandoned;
+    registry.publish(3, 1, abandoned);
+  }
+
+  // The registry holds pending props weakly.
+  EXPECT(observed.expired());
+  EXPECT(!registry.mount(3, 1));
+  EXPECT(registry.size() == 0);
+
+  // Orphaned tags are swept on the next publish.
+  {
+    auto orphan = makeProps(10, "orphan", 1);
+    registry.publish(4, 1, orphan);
+  }
+  auto live = makeProps(10, "live", 1);
+  registry.publish(5, 1, live);
+  EXPECT(registry.size() == 1);
+}
+
+void testMountedPropsOutliveShadowTree() {
+  PCSelectionMenuOptionRegistry registry;
+  {
+    auto props = makeProps(10, "mounted", 1);
+    registry.publish(9, 1, props);
+    EXPECT(registry.mount(9, 1));
+  }
+
+  size_t count = 0;
+  registry.withProvider(9, [&](auto& provider) { count = provider.count(); });
+  EXPECT(count == 10);
+}
+
+} // namespace
+
+int main() {
+  testSetPropsDetectsChanges();
+  testVisitorSlotsMatchWindow();
+  testUnchangedOptionsFetchNothing();
+  testOutOfRangeRowsFetchNothing();
+  testRegistryServesOnlyMountedRevision();
+  testRegistryDropsRendersThatNeverMount();
+  testMountedPropsOutliveShadowTree();
+
+  return pc_test::finish("PCSelectionMenuOptionProviderTest");
+}
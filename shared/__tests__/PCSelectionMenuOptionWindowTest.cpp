@@ -0,0 +1,196 @@
+#include "PCSelectionMenuOptionWindow.h"
+
+#include <vector>
+
+#include "TestHarness.h"
+
+using facebook::react::PCSelectionMenuOptionRange;
+using facebook::react::PCSelectionMenuOptionWindow;
+
+namespace {
+
+// Mirrors what native does with an update: write fetched rows into their slots.
+struct SlotStorage {
+  explicit SlotStorage(size_t capacity) : slots(capacity, -1) {}
+
+  size_t apply(const PCSelectionMenuOptionWindow& window,
+               const PCSelectionMenuOptionWindow::Update& update) {
+    for (size_t i = update.load.location; i < update.load.end(); i++) {
+      slots[window.slotFor(i)] = static_cast<long>(i);
+    }
+    return update.load.length;
+  }
+
+  bool holds(const PCSelectionMenuOptionWindow& window, size_t index) const {
+    return slots[window.slotFor(index)] == static_cast<long>(index);
+  }
+
+  std::vector<long> slots;
+};
+
+void testEmpty() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(0);
+  const auto update = window.update({0, 15});
+  EXPECT(update.resident.empty());
+  EXPECT(update.load.empty());
+}
+
+void testSmallListLoadsOnce() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(10);
+
+  auto update = window.update({0, 10});
+  EXPECT((update.resident == PCSelectionMenuOptionRange{0, 10}));
+  EXPECT((update.load == PCSelectionMenuOptionRange{0, 10}));
+
+  update = window.update({5, 5});
+  EXPECT(update.load.empty());
+  update = window.touch(9);
+  EXPECT(update.load.empty());
+}
+
+void testInitialWindowAtTop() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+  EXPECT(window.capacity() == 32);
+
+  const auto update = window.update({0, 15});
+  EXPECT((update.resident == PCSelectionMenuOptionRange{0, 32}));
+  EXPECT((update.load == update.resident));
+}
+
+void testSmallScrollDoesNotFetch() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+  window.update({0, 15});
+
+  // Visible rows stay more than half a prefetch window from the bottom edge.
+  for (size_t first = 1; first <= 13; first++) {
+    EXPECT(window.update({first, 15}).load.empty());
+  }
+}
+
+void testScrollDownFetchesOnlyNewRows() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+  window.update({0, 15});
+
+  // Bottom margin drops below 4 rows: window recenters.
+  const auto update = window.update({14, 15});
+  EXPECT(update.resident.contains(PCSelectionMenuOptionRange{14, 15}));
+  EXPECT(update.resident.length == 32);
+  EXPECT(update.load.location == 32);
+  EXPECT(update.load.end() == update.resident.end());
+}
+
+void testScrollUpFetchesOnlyNewRows() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+  window.update({1000, 15});
+  const auto before = window.resident();
+
+  const auto update = window.update({before.location + 1, 15});
+  EXPECT(update.load.location == update.resident.location);
+  EXPECT(update.load.end() == before.location);
+}
+
+void testJumpRefetchesWholeWindow() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+  window.update({0, 15});
+
+  const auto update = window.update({25000, 15});
+  EXPECT(update.resident.contains(PCSelectionMenuOptionRange{25000, 15}));
+  EXPECT((update.load == update.resident));
+}
+
+void testEndOfListClamps() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+
+  auto update = window.update({49990, 15});
+  EXPECT(update.resident.end() == 50000);
+  EXPECT(update.resident.length == 32);
+
+  // Already pinned to the end: no refetch even though the margin is 0.
+  update = window.update({49985, 15});
+  EXPECT(update.load.empty());
+
+  // Out-of-range rows clamp to the last row.
+  update = window.touch(60000);
+  EXPECT(update.resident.end() == 50000);
+}
+
+void testResetDropsResidentRows() {
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(50000);
+  window.update({100, 15});
+
+  window.reset(200);
+  EXPECT(window.resident().empty());
+  const auto update = window.update({100, 15});
+  EXPECT((update.load == update.resident));
+  EXPECT(update.resident.end() <= 200);
+}
+
+// Scroll through a 50k list the way a table view does (whole visible range)
+// and check that recycled slots always hold the visible rows and that each
+// row is fetched about once.
+void testFullScrollRecyclesSlots() {
+  const size_t count = 50000;
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(count);
+  SlotStorage storage(window.capacity());
+
+  size_t fetched = 0;
+  for (size_t first = 0; first + 15 <= count; first++) {
+    fetched += storage.apply(window, window.update({first, 15}));
+    for (size_t i = first; i < first + 15; i++) {
+      if (!storage.holds(window, i)) {
+        EXPECT(storage.holds(window, i));
+        return;
+      }
+    }
+  }
+  EXPECT(fetched == count);
+}
+
+// Adapters (Android ListView, iOS cellForRow) only ever ask for one row.
+void testRowByRowScrollRecyclesSlots() {
+  const size_t count = 5000;
+  PCSelectionMenuOptionWindow window(16, 8);
+  window.reset(count);
+  SlotStorage storage(window.capacity());
+
+  size_t fetched = 0;
+  for (size_t first = 0; first + 15 <= count; first += 3) {
+    for (size_t i = first; i < first + 15; i++) {
+      fetched += storage.apply(window, window.touch(i));
+      if (!storage.holds(window, i)) {
+        EXPECT(storage.holds(window, i));
+        return;
+      }
+    }
+  }
+  // Each move fetches a batch; never refetch the whole list many times over.
+  EXPECT(fetched < 2 * count);
+}
+
+} // namespace
+
+int main() {
+  testEmpty();
+  testSmallListLoadsOnce();
+  testInitialWindowAtTop();
+  testSmallScrollDoesNotFetch();
+  testScrollDownFetchesOnlyNewRows();
+  testScrollUpFetchesOnlyNewRows();
+  testJumpRefetchesWholeWindow();
+  testEndOfListClamps();
+  testResetDropsResidentRows();
+  testFullScrollRecyclesSlots();
+  testRowByRowScrollRecyclesSlots();
+
+  return pc_test::finish("PCSelectionMenuOptionWindowTest");
+}
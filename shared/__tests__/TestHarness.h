@@ -0,0 +1,31 @@
+#pragma once
+
+// Minimal assertion helpers shared by the host-only unit tests (no gtest).
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace pc_test {
+
+inline int failures = 0;
+
+// Prints the result and returns the process exit code.
+inline int finish(const char* suite) {
+  if (failures > 0) {
+    std::fprintf(stderr, "%d expectation(s) failed\n", failures);
+    return EXIT_FAILURE;
+  }
+  std::printf("%s: all tests passed\n", suite);
+  return EXIT_SUCCESS;
+}
+
+} // namespace pc_test
+
+#define EXPECT(cond)                                              \
+  do {                                                            \
+    if (!(cond)) {                                                \
+      std::fprintf(stderr, "%s:%d: EXPECT(%s) failed\n", __FILE__, \
+                   __LINE__, #cond);                              \
+      pc_test::failures++;                                        \
+    }                                                             \
+  } while (0)
@@ -0,0 +1,25 @@
+#pragma once
+
+// Minimal stand-in for the codegen-generated Props.h so provider code can be
+// unit tested on the host. Only the fields the provider reads are declared.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+using Tag = int32_t;
+
+struct PCSelectionMenuOptionsStruct {
+  std::string label{};
+  std::string data{};
+};
+
+struct PCSelectionMenuProps {
+  std::vector<PCSelectionMenuOptionsStruct> options{};
+  std::string virtualization{};
+  int optionsRevision{0};
+};
+
+} // namespace facebook::react
@@ -48,6 +48,13 @@ export interface SelectionMenuProps extends ViewProps {
    */
   onRequestClose?: () => void;
 
+  /**
+   * Deliver options to native on demand instead of all at once.
+   * Recommended for very large lists (thousands of options): open latency
+   * and native memory no longer grow with the option count.
+   */
+  virtualized?: boolean;
+
   /**
    * Pass-through platform props.
    */
@@ -62,6 +69,9 @@ export interface SelectionMenuProps extends ViewProps {
   testID?: string;
 }
 
+// Shared across instances so a revision is never reused for different options.
+let nextOptionsRevision = 1;
+
 function normalizeSelectedData(selected: string | null): string {
   return selected ?? '';
 }
@@ -86,6 +96,7 @@ export function SelectionMenu(props: SelectionMenuProps): React.ReactElement {
     visible,
     onSelect,
     onRequestClose,
+    virtualized,
     ios,
     android,
     ...viewProps
@@ -96,6 +107,12 @@ export function SelectionMenu(props: SelectionMenuProps): React.ReactElement {
     [selected]
   );
 
+  // A new `options` array gets a new revision (virtualized only).
+  const optionsRevision = useMemo(
+    () => (virtualized ? nextOptionsRevision++ : 0),
+    [virtualized, options]
+  );
+
   const nativeVisible = useMemo(
     () => normalizeNativeVisible(presentation, visible),
     [presentation, visible]
@@ -136,6 +153,8 @@ export function SelectionMenu(props: SelectionMenuProps): React.ReactElement {
       placeholder={placeholder}
       anchorMode={presentation === 'embedded' ? 'inline' : 'headless'}
       visible={nativeVisible}
+      virtualization={virtualized ? 'enabled' : 'disabled'}
+      optionsRevision={optionsRevision}
       onSelect={onSelect ? handleSelect : undefined}
       onRequestClose={onRequestClose ? handleRequestClose : undefined}
       ios={ios}
@@ -33,6 +33,9 @@ export type SelectionMenuInteractivity = 'enabled' | 'disabled';
 /** Anchor behavior (no booleans). */
 export type SelectionMenuAnchorMode = 'inline' | 'headless';
 
+/** Option delivery (no booleans). */
+export type SelectionMenuVirtualization = 'enabled' | 'disabled';
+
 /**
  * iOS-specific configuration (reserved).
  */
@@ -80,6 +83,20 @@ export interface SelectionMenuProps extends ViewProps {
    */
   visible?: string; // SelectionMenuVisible
 
+  /**
+   * Option delivery:
+   * - "disabled" (default): native receives every option up front.
+   * - "enabled": native only receives the option count and fetches rows
+   *   from the shadow-tree props as they scroll into view.
+   */
+  virtualization?: string; // SelectionMenuVirtualization
+
+  /**
+   * Virtualized only: changes whenever `options` changes. Android uses it to
+   * serve rows from the props that were actually mounted.
+   */
+  optionsRevision?: CodegenTypes.WithDefault<CodegenTypes.Int32, 0>;
+
   /**
    * Fired when the user selects an option.
    */
@@ -156,6 +156,53 @@ describe('SelectionMenu', () => {
       tree.unmount();
     });
   });
+
+  it('maps virtualized to native virtualization', () => {
+    let tree: ReturnType<typeof renderer.create>;
+    act(() => {
+      tree = renderer.create(
+        <SelectionMenu
+          options={[{ label: 'A', data: 'a' }]}
+          selected={null}
+          virtualized
+        />
+      );
+    });
+
+    expect(NativeSelectionMenu.mock.calls[0][0].virtualization).toBe(
+      'enabled'
+    );
+    const firstRevision = NativeSelectionMenu.mock.calls[0][0].optionsRevision;
+    expect(firstRevision).toBeGreaterThan(0);
+
+    act(() => {
+      tree.update(
+        <SelectionMenu
+          options={[{ label: 'B', data: 'b' }]}
+          selected={null}
+          virtualized
+        />
+      );
+    });
+
+    const updated =
+      NativeSelectionMenu.mock.calls[NativeSelectionMenu.mock.calls.length - 1];
+    expect(updated[0].optionsRevision).toBeGreaterThan(firstRevision);
+
+    act(() => {
+      tree.update(
+        <SelectionMenu options={[{ label: 'A', data: 'a' }]} selected={null} />
+      );
+    });
+
+    const lastCall =
+      NativeSelectionMenu.mock.calls[NativeSelectionMenu.mock.calls.length - 1];
+    expect(lastCall[0].virtualization).toBe('disabled');
+    expect(lastCall[0].optionsRevision).toBe(0);
+    act(() => {
+      tree.unmount();
+    });
+  });
 });
 
 describe('LiquidGlass', () => {
@@ -59,6 +59,7 @@ export interface SelectionMenuProps extends ViewProps {
   visible?: boolean;
   onSelect?: (data: string, label: string, index: number) => void;
   onRequestClose?: () => void;
+  virtualized?: boolean;
   ios?: Record<string, unknown>;
   android?: Record<string, unknown>;
 }